@@ -1,3 +1,5 @@
+#define QR_BLOCK 64   // Rows per block in qr_svdcmp(), whose work is ncols*QR_BLOCK
+
 class SingularValueDecomp {
 
 public:
@@ -5,6 +7,7 @@ public:
    SingularValueDecomp ( int nrows , int ncols , int save_a=0 ) ;
    ~SingularValueDecomp () ;
    void svdcmp () ;
+   void qr_svdcmp ( SingularValueDecomp *rsvd , double *qrwork ) ; // QRSVD.CPP
    void backsub ( double limit , double *soln ) ;
 
    int ok ;         // Was everything legal and allocs successful?